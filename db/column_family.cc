@@ -30,6 +30,7 @@
 #include "util/autovector.h"
 #include "util/compression.h"
 #include "util/options_helper.h"
+#include "util/string_util.h"
 #include "util/thread_status_util.h"
 #include "util/xfunc.h"
 
@@ -103,6 +104,13 @@ void GetIntTblPropCollectorFactory(
 
 Status CheckCompressionSupported(const ColumnFamilyOptions& cf_options) {
   if (!cf_options.compression_per_level.empty()) {
+    if (cf_options.compression_per_level.size() >
+        static_cast<size_t>(ImmutableCFOptions::kCompressionPerLevelCapacity)) {
+      return Status::InvalidArgument(
+          "compression_per_level cannot have more than " +
+          ToString(ImmutableCFOptions::kCompressionPerLevelCapacity) +
+          " entries.");
+    }
     for (size_t level = 0; level < cf_options.compression_per_level.size();
          ++level) {
       if (!CompressionTypeSupported(cf_options.compression_per_level[level])) {
@@ -123,6 +131,27 @@ Status CheckCompressionSupported(const ColumnFamilyOptions& cf_options) {
   return Status::OK();
 }
 
+Status CheckMaxBytesMultiplierAdditional(
+    const ColumnFamilyOptions& cf_options) {
+  // MutableCFOptions stores the first kMultiplierAdditionalCapacity entries
+  // inline and treats every level past the stored length as the default
+  // multiplier of 1. Longer vectors are therefore only accepted when the
+  // extra entries hold the default: the ColumnFamilyOptions constructor
+  // resizes the vector to num_levels with 1s, which must keep working for
+  // num_levels > kMultiplierAdditionalCapacity.
+  for (size_t level = MutableCFOptions::kMultiplierAdditionalCapacity;
+       level < cf_options.max_bytes_for_level_multiplier_additional.size();
+       ++level) {
+    if (cf_options.max_bytes_for_level_multiplier_additional[level] != 1) {
+      return Status::InvalidArgument(
+          "max_bytes_for_level_multiplier_additional cannot have a "
+          "non-default entry beyond level " +
+          ToString(MutableCFOptions::kMultiplierAdditionalCapacity - 1) + ".");
+    }
+  }
+  return Status::OK();
+}
+
 Status CheckConcurrentWritesSupported(const ColumnFamilyOptions& cf_options) {
   if (cf_options.inplace_update_support) {
     return Status::InvalidArgument(
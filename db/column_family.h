@@ -133,6 +133,9 @@ struct SuperVersion {
 
 extern Status CheckCompressionSupported(const ColumnFamilyOptions& cf_options);
 
+extern Status CheckMaxBytesMultiplierAdditional(
+    const ColumnFamilyOptions& cf_options);
+
 extern Status CheckConcurrentWritesSupported(
     const ColumnFamilyOptions& cf_options);
 
@@ -230,6 +230,9 @@ static Status ValidateOptions(
 
   for (auto& cfd : column_families) {
     s = CheckCompressionSupported(cfd.options);
+    if (s.ok()) {
+      s = CheckMaxBytesMultiplierAdditional(cfd.options);
+    }
     if (s.ok() && db_options.allow_concurrent_memtable_write) {
       s = CheckConcurrentWritesSupported(cfd.options);
     }
@@ -275,7 +278,7 @@ CompressionType GetCompressionFlush(
         (ioptions.compaction_options_universal.compression_size_percent < 0);
   } else {
     // For leveled compress when min_level_to_compress == 0.
-    can_compress = ioptions.compression_per_level.empty() ||
+    can_compress = ioptions.compression_per_level_length == 0 ||
                    ioptions.compression_per_level[0] != kNoCompression;
   }
 
@@ -3899,6 +3902,9 @@ Status DBImpl::CreateColumnFamily(const ColumnFamilyOptions& cf_options,
   *handle = nullptr;
 
   s = CheckCompressionSupported(cf_options);
+  if (s.ok()) {
+    s = CheckMaxBytesMultiplierAdditional(cf_options);
+  }
   if (s.ok() && db_options_.allow_concurrent_memtable_write) {
     s = CheckConcurrentWritesSupported(cf_options);
   }
@@ -4367,7 +4373,7 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
     RecordTick(stats_, WRITE_WITH_WAL);
   }
 
-  StopWatch write_sw(env_, db_options_.statistics.get(), DB_WRITE);
+  StopWatch write_sw(env_, stats_, DB_WRITE);
 
   write_thread_.JoinBatchGroup(&w);
   if (w.state == WriteThread::STATE_PARALLEL_FOLLOWER) {
@@ -500,6 +500,11 @@ class DBImpl : public DB {
   Env* const env_;
   const std::string dbname_;
   unique_ptr<VersionSet> versions_;
+  // Cold configuration. Per-operation code should not reach into this struct:
+  // hot column family settings are copied into ImmutableCFOptions (raw
+  // pointers, fixed for the DB lifetime) and MutableCFOptions (reached
+  // through the SuperVersion), and frequently read DB-level handles are
+  // cached as plain members here (env_ above, stats_ below).
   const DBOptions db_options_;
   Statistics* stats_;
   std::unordered_map<std::string, RecoveredTransaction*>
@@ -39,11 +39,13 @@
 #include "rocksdb/env.h"
 #include "rocksdb/experimental.h"
 #include "rocksdb/filter_policy.h"
+#include "rocksdb/immutable_options.h"
 #include "rocksdb/options.h"
 #include "rocksdb/perf_context.h"
 #include "rocksdb/slice.h"
 #include "rocksdb/slice_transform.h"
 #include "rocksdb/snapshot.h"
+#include "rocksdb/sst_file_writer.h"
 #include "rocksdb/table.h"
 #include "rocksdb/table_properties.h"
 #include "rocksdb/thread_status.h"
@@ -1246,6 +1248,24 @@ TEST_F(DBTest, MinLevelToCompress2) {
   MinLevelHelper(this, options);
 }
 
+TEST_F(DBTest, CompressionPerLevelCapacity) {
+  const int kCapacity = ImmutableCFOptions::kCompressionPerLevelCapacity;
+
+  Options options = CurrentOptions();
+  options.num_levels = kCapacity + 1;
+  options.compression_per_level.resize(kCapacity + 1, kNoCompression);
+  ASSERT_TRUE(TryReopen(options).IsInvalidArgument());
+
+  // SstFileWriter builds its ImmutableCFOptions straight from the caller's
+  // Options without going through DB::Open, so it enforces the same limit.
+  SstFileWriter sst_file_writer(EnvOptions(), options, options.comparator);
+  ASSERT_TRUE(
+      sst_file_writer.Open(dbname_ + "/overlong.sst").IsInvalidArgument());
+
+  options.compression_per_level.resize(kCapacity, kNoCompression);
+  ASSERT_OK(TryReopen(options));
+}
+
 TEST_F(DBTest, RepeatedWritesToSameKey) {
   do {
     Options options = CurrentOptions();
@@ -4257,6 +4277,7 @@ TEST_F(DBTest, DynamicCompactionOptions) {
   options.env = env_;
   options.create_if_missing = true;
   options.compression = kNoCompression;
+  options.max_background_compactions = 1;
   options.soft_pending_compaction_bytes_limit = 1024 * 1024;
   options.write_buffer_size = k64KB;
   options.arena_block_size = 4 * k4KB;
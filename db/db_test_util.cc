@@ -210,6 +210,7 @@ Options DBTestBase::CurrentOptions(
   options.max_bytes_for_level_base = 10 * 1024 * 1024;
   options.max_open_files = 5000;
   options.base_background_compactions = -1;
+  options.max_background_compactions = 1;
   options.wal_recovery_mode = WALRecoveryMode::kTolerateCorruptedTailRecords;
   options.compaction_pri = CompactionPri::kByCompensatedSize;
 
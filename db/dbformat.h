@@ -119,9 +119,22 @@ inline ValueType ExtractValueType(const Slice& internal_key) {
 class InternalKeyComparator : public Comparator {
  private:
   const Comparator* user_comparator_;
+  // Cached at construction so the hot compare path can skip the virtual
+  // call and use the inlined Slice comparison for the common case of the
+  // builtin bytewise comparator.
+  bool user_comparator_is_bytewise_;
   std::string name_;
+
+  int CompareUserKeys(const Slice& a, const Slice& b) const {
+    if (user_comparator_is_bytewise_) {
+      return a.compare(b);
+    }
+    return user_comparator_->Compare(a, b);
+  }
+
  public:
   explicit InternalKeyComparator(const Comparator* c) : user_comparator_(c),
+    user_comparator_is_bytewise_(c == BytewiseComparator()),
     name_("rocksdb.InternalKeyComparator:" +
           std::string(user_comparator_->Name())) {
   }
@@ -40,6 +40,7 @@ class DeleteFileTest : public testing::Test {
     env_ = Env::Default();
     options_.delete_obsolete_files_period_micros = 0;  // always do full purge
     options_.enable_thread_tracking = true;
+    options_.max_background_compactions = 1;
     options_.write_buffer_size = 1024*1024*1000;
     options_.target_file_size_base = 1024*1024*1000;
     options_.max_bytes_for_level_base = 1024*1024*1000;
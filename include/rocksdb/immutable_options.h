@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <array>
 #include <string>
 #include <vector>
 #include "rocksdb/options.h"
@@ -20,20 +21,25 @@ namespace rocksdb {
 struct ImmutableCFOptions {
   explicit ImmutableCFOptions(const Options& options);
 
-  CompactionStyle compaction_style;
+  // Fields consulted on per-key and per-block paths come first so that they
+  // share as few cache lines as possible. Everything from compaction_style
+  // on is only read at open time or once per flush/compaction.
 
-  CompactionOptionsUniversal compaction_options_universal;
-  CompactionOptionsFIFO compaction_options_fifo;
+  const Comparator* comparator;
 
   const SliceTransform* prefix_extractor;
 
-  const Comparator* comparator;
-
   MergeOperator* merge_operator;
 
-  const CompactionFilter* compaction_filter;
+  Statistics* statistics;
 
-  CompactionFilterFactory* compaction_filter_factory;
+  Logger* info_log;
+
+  Env* env;
+
+  int num_levels;
+
+  bool optimize_filters_for_hits;
 
   bool inplace_update_support;
 
@@ -42,13 +48,24 @@ struct ImmutableCFOptions {
                                    Slice delta_value,
                                    std::string* merged_value);
 
-  Logger* info_log;
+  MemTableRepFactory* memtable_factory;
 
-  Statistics* statistics;
+  TableFactory* table_factory;
 
-  InfoLogLevel info_log_level;
+  std::shared_ptr<Cache> row_cache;
 
-  Env* env;
+  // Cold fields below; read at open time or per flush/compaction.
+
+  CompactionStyle compaction_style;
+
+  CompactionOptionsUniversal compaction_options_universal;
+  CompactionOptionsFIFO compaction_options_fifo;
+
+  const CompactionFilter* compaction_filter;
+
+  CompactionFilterFactory* compaction_filter_factory;
+
+  InfoLogLevel info_log_level;
 
   uint64_t delayed_write_rate;
 
@@ -60,10 +77,6 @@ struct ImmutableCFOptions {
 
   std::vector<DbPath> db_paths;
 
-  MemTableRepFactory* memtable_factory;
-
-  TableFactory* table_factory;
-
   Options::TablePropertiesCollectorFactories
     table_properties_collector_factories;
 
@@ -79,7 +92,22 @@ struct ImmutableCFOptions {
 
   bool use_fsync;
 
-  std::vector<CompressionType> compression_per_level;
+  // Maximum number of per-level compression overrides that can be stored
+  // inline in compression_per_level below. ColumnFamilyOptions with a longer
+  // compression_per_level vector are rejected when the column family is
+  // opened.
+  static const int kCompressionPerLevelCapacity = 16;
+
+  // Per-level compression overrides, copied from
+  // ColumnFamilyOptions::compression_per_level. Stored inline (instead of in
+  // a heap-allocated vector) so that looking up the compression type of a
+  // level on the compaction write path is a single load from this struct.
+  // Only the first compression_per_level_length entries are valid; the
+  // length is 0 when no per-level overrides are configured.
+  std::array<CompressionType, kCompressionPerLevelCapacity>
+      compression_per_level;
+
+  int compression_per_level_length;
 
   CompressionType bottommost_compression;
 
@@ -93,15 +121,9 @@ struct ImmutableCFOptions {
 
   size_t compaction_readahead_size;
 
-  int num_levels;
-
-  bool optimize_filters_for_hits;
-
   // A vector of EventListeners which call-back functions will be called
   // when specific RocksDB event happens.
   std::vector<std::shared_ptr<EventListener>> listeners;
-
-  std::shared_ptr<Cache> row_cache;
 };
 
 }  // namespace rocksdb
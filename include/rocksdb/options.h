@@ -63,7 +63,14 @@ enum CompressionType : unsigned char {
   kLZ4Compression = 0x4,
   kLZ4HCCompression = 0x5,
   kXpressCompression = 0x6,
-  // zstd format is not finalized yet so it's subject to changes.
+  // zstd with its finalized format (v0.8.0+). Offers a better ratio than
+  // the faster codecs at a moderate CPU cost, which makes it a good fit for
+  // cold/archival levels, e.g. via bottommost_compression.
+  kZSTDCompression = 0x7,
+
+  // zstd format from before it was finalized; it's subject to changes.
+  // Only use this if you have to read data written with a pre-0.8.0 zstd
+  // library; use kZSTDCompression for new data.
   kZSTDNotFinalCompression = 0x40,
 
   // kDisableCompressionOption is used to disable some compression options.
@@ -131,9 +138,7 @@ struct CompactionOptionsFIFO {
   // once the total sum of table files reaches this, we will delete the oldest
   // table file
   // Default: 1GB
-  uint64_t max_table_files_size;
-
-  CompactionOptionsFIFO() : max_table_files_size(1 * 1024 * 1024 * 1024) {}
+  uint64_t max_table_files_size = 1 * 1024 * 1024 * 1024;
 };
 
 // Compression options for different compression algorithms like Zlib
@@ -150,14 +155,26 @@ struct CompressionOptions {
   // A value of 0 indicates the feature is disabled.
   // Default: 0.
   uint32_t max_dict_bytes;
+  // When true, a sample of each block is probed for byte diversity before
+  // the compression library is invoked, and blocks that look incompressible
+  // (e.g. values that are already compressed or encrypted) are stored
+  // uncompressed without paying for a full compression pass that would be
+  // thrown away anyway for not reaching the required compression ratio.
+  // Default: false.
+  bool probe_compressibility;
 
   CompressionOptions()
-      : window_bits(-14), level(-1), strategy(0), max_dict_bytes(0) {}
+      : window_bits(-14),
+        level(-1),
+        strategy(0),
+        max_dict_bytes(0),
+        probe_compressibility(false) {}
   CompressionOptions(int wbits, int _lev, int _strategy, int _max_dict_bytes)
       : window_bits(wbits),
         level(_lev),
         strategy(_strategy),
-        max_dict_bytes(_max_dict_bytes) {}
+        max_dict_bytes(_max_dict_bytes),
+        probe_compressibility(false) {}
 };
 
 enum UpdateStatus {    // Return status For inplace update callback
@@ -168,9 +185,10 @@ enum UpdateStatus {    // Return status For inplace update callback
 
 struct DbPath {
   std::string path;
-  uint64_t target_size;  // Target size of total files under the path, in byte.
+  // Target size of total files under the path, in byte.
+  uint64_t target_size = 0;
 
-  DbPath() : target_size(0) {}
+  DbPath() {}
   DbPath(const std::string& p, uint64_t t) : path(p), target_size(t) {}
 };
 
@@ -337,16 +355,17 @@ struct ColumnFamilyOptions {
   // Compress blocks using the specified compression algorithm.  This
   // parameter can be changed dynamically.
   //
-  // Default: kSnappyCompression, if it's supported. If snappy is not linked
-  // with the library, the default is kNoCompression.
+  // Default: kLZ4Compression, if it's supported. If LZ4 is not linked with
+  // the library, fall back to kSnappyCompression, and to kNoCompression if
+  // snappy is not linked either.
   //
-  // Typical speeds of kSnappyCompression on an Intel(R) Core(TM)2 2.4GHz:
-  //    ~200-500MB/s compression
-  //    ~400-800MB/s decompression
+  // LZ4 typically compresses and decompresses faster than snappy while
+  // achieving a comparable or better compression ratio, so it reduces both
+  // the CPU spent on block (de)compression and the bytes read from disk.
   // Note that these speeds are significantly faster than most
   // persistent storage speeds, and therefore it is typically never
   // worth switching to kNoCompression.  Even if the input data is
-  // incompressible, the kSnappyCompression implementation will
+  // incompressible, these compression implementations will
   // efficiently detect that and will switch to uncompressed mode.
   CompressionType compression;
 
@@ -557,9 +576,10 @@ struct ColumnFamilyOptions {
   // Dynamically changeable through SetOptions() API
   int max_grandparent_overlap_factor;
 
-  // DEPRECATED -- this options is no longer used
-  // Puts are delayed to options.delayed_write_rate when any level has a
-  // compaction score that exceeds soft_rate_limit. This is ignored when == 0.0.
+  // DEPRECATED -- this options is no longer used. The floating-point ratio
+  // check it used to drive was replaced by the integer thresholds
+  // soft_pending_compaction_bytes_limit and delayed_write_rate below, which
+  // are what the write stall code compares on the write path.
   //
   // Default: 0 (disabled)
   //
@@ -964,6 +984,10 @@ struct DBOptions {
   // If it is non empty, the log files will be in the specified dir,
   // and the db data dir's absolute path will be used as the log file
   // name's prefix.
+  // Deliberately an owning std::string (like wal_dir below): DBOptions is
+  // only copied when a DB is opened, so the copy cost does not matter, and
+  // a raw pointer would force callers to keep the buffer alive for the
+  // lifetime of the DB.
   std::string db_log_dir;
 
   // This specifies the absolute dir path for write-ahead logs (WAL).
@@ -996,7 +1020,7 @@ struct DBOptions {
   // If you're increasing this, also consider increasing number of threads in
   // LOW priority thread pool. For more information, see
   // Env::SetBackgroundThreads
-  // Default: 1
+  // Default: 2
   int max_background_compactions;
 
   // This value represents the maximum number of threads that will
@@ -1238,6 +1262,12 @@ struct DBOptions {
   // When rate limiter is enabled, it automatically enables bytes_per_sync
   // to 1MB.
   //
+  // On Linux this maps to sync_file_range(): besides smoothing I/O, it keeps
+  // dirty pages produced by flush and compaction from piling up in the page
+  // cache, where they would otherwise evict hot blocks and turn the final
+  // fsync into a large synchronous writeback. Consider 1MB for
+  // compaction-heavy, read-latency-sensitive workloads.
+  //
   // This option applies to table files
   uint64_t bytes_per_sync;
 
@@ -1281,7 +1311,7 @@ struct DBOptions {
   // This can substantially improve throughput for concurrent workloads,
   // regardless of whether allow_concurrent_memtable_write is enabled.
   //
-  // Default: false
+  // Default: true
   bool enable_write_thread_adaptive_yield;
 
   // The maximum number of microseconds that a write operation will use
@@ -1406,25 +1436,12 @@ enum ReadTier {
 };
 
 // Options that control read operations
+//
+// ReadOptions is copied on every read operation, so members are ordered by
+// descending alignment to avoid padding holes, and the boolean flags are
+// declared as one-bit bitfields to keep the struct small. The flags still
+// read and assign like plain bools.
 struct ReadOptions {
-  // If true, all data read from underlying storage will be
-  // verified against corresponding checksums.
-  // Default: true
-  bool verify_checksums;
-
-  // Should the "data block"/"index block"/"filter block" read for this
-  // iteration be cached in memory?
-  // Callers may wish to set this field to false for bulk scans.
-  // Default: true
-  bool fill_cache;
-
-  // If this option is set and memtable implementation allows, Seek
-  // might only return keys with the same prefix as the seek-key
-  //
-  // ! DEPRECATED: prefix_seek is on by default when prefix_extractor
-  // is configured
-  // bool prefix_seek;
-
   // If "snapshot" is non-nullptr, read as of the supplied snapshot
   // (which must belong to the DB that is being read and which must
   // not have been released).  If "snapshot" is nullptr, use an impliicit
@@ -1459,26 +1476,50 @@ struct ReadOptions {
   // Default: nullptr
   const Slice* iterate_upper_bound;
 
+  // If non-zero, NewIterator will create a new table reader which
+  // performs reads of the given size. Using a large size (> 2MB) can
+  // improve the performance of forward iteration on spinning disks.
+  // Default: 0
+  size_t readahead_size;
+
   // Specify if this read request should process data that ALREADY
   // resides on a particular cache. If the required data is not
   // found at the specified cache, then Status::Incomplete is returned.
   // Default: kReadAllTier
   ReadTier read_tier;
 
+  // If true, all data read from underlying storage will be
+  // verified against corresponding checksums.
+  // Default: true
+  bool verify_checksums : 1;
+
+  // Should the "data block"/"index block"/"filter block" read for this
+  // iteration be cached in memory?
+  // Callers may wish to set this field to false for bulk scans.
+  // Default: true
+  bool fill_cache : 1;
+
+  // If this option is set and memtable implementation allows, Seek
+  // might only return keys with the same prefix as the seek-key
+  //
+  // ! DEPRECATED: prefix_seek is on by default when prefix_extractor
+  // is configured
+  // bool prefix_seek;
+
   // Specify to create a tailing iterator -- a special iterator that has a
   // view of the complete database (i.e. it can also be used to read newly
   // added data) and is optimized for sequential reads. It will return records
   // that were inserted into the database after the creation of the iterator.
   // Default: false
   // Not supported in ROCKSDB_LITE mode!
-  bool tailing;
+  bool tailing : 1;
 
   // Specify to create a managed iterator -- a special iterator that
   // uses less resources by having the ability to free its underlying
   // resources on request.
   // Default: false
   // Not supported in ROCKSDB_LITE mode!
-  bool managed;
+  bool managed : 1;
 
   // Enable a total order seek regardless of index format (e.g. hash index)
   // used in the table. Some table format (e.g. plain table) may not support
@@ -1486,7 +1527,7 @@ struct ReadOptions {
   // If true when calling Get(), we also skip prefix bloom when reading from
   // block based table. It provides a way to read exisiting data after
   // changing implementation of prefix extractor.
-  bool total_order_seek;
+  bool total_order_seek : 1;
 
   // Enforce that the iterator only iterates over the same prefix as the seek.
   // This option is effective only for prefix seeks, i.e. prefix_extractor is
@@ -1494,7 +1535,7 @@ struct ReadOptions {
   // iterate_upper_bound, prefix_same_as_start only works within a prefix
   // but in both directions.
   // Default: false
-  bool prefix_same_as_start;
+  bool prefix_same_as_start : 1;
 
   // Keep the blocks loaded by the iterator pinned in memory as long as the
   // iterator is not deleted, If used when reading from tables created with
@@ -1502,26 +1543,27 @@ struct ReadOptions {
   // Iterator's property "rocksdb.iterator.is-key-pinned" is guaranteed to
   // return 1.
   // Default: false
-  bool pin_data;
+  bool pin_data : 1;
 
   // If true, when PurgeObsoleteFile is called in CleanupIteratorState, we
   // schedule a background job in the flush job queue and delete obsolete files
   // in background.
   // Default: false
-  bool background_purge_on_iterator_cleanup;
-
-  // If non-zero, NewIterator will create a new table reader which
-  // performs reads of the given size. Using a large size (> 2MB) can
-  // improve the performance of forward iteration on spinning disks.
-  // Default: 0
-  size_t readahead_size;
+  bool background_purge_on_iterator_cleanup : 1;
 
   ReadOptions();
   ReadOptions(bool cksum, bool cache);
 };
 
 // Options that control write operations
+//
+// Like ReadOptions, members are ordered by descending alignment and the
+// boolean flags are one-bit bitfields; WriteOptions is copied on every
+// write operation, so keeping it small reduces the bytes moved per op.
 struct WriteOptions {
+  // The option is deprecated. It's not used anymore.
+  uint64_t timeout_hint_us;
+
   // If true, the write will be flushed from the operating system
   // buffer cache (by calling WritableFile::Sync()) before the write
   // is considered complete.  If this flag is true, writes will be
@@ -1538,25 +1580,22 @@ struct WriteOptions {
   // system call followed by "fdatasync()".
   //
   // Default: false
-  bool sync;
+  bool sync : 1;
 
   // If true, writes will not first go to the write ahead log,
   // and the write may got lost after a crash.
-  bool disableWAL;
-
-  // The option is deprecated. It's not used anymore.
-  uint64_t timeout_hint_us;
+  bool disableWAL : 1;
 
   // If true and if user is trying to write to column families that don't exist
   // (they were dropped),  ignore the write (don't return an error). If there
   // are multiple writes in a WriteBatch, other writes will succeed.
   // Default: false
-  bool ignore_missing_column_families;
+  bool ignore_missing_column_families : 1;
 
   WriteOptions()
-      : sync(false),
+      : timeout_hint_us(0),
+        sync(false),
         disableWAL(false),
-        timeout_hint_us(0),
         ignore_missing_column_families(false) {}
 };
 
@@ -1564,9 +1603,7 @@ struct WriteOptions {
 struct FlushOptions {
   // If true, the flush will wait until the flush is done.
   // Default: true
-  bool wait;
-
-  FlushOptions() : wait(true) {}
+  bool wait = true;
 };
 
 // Create a Logger from provided DBOptions
@@ -1578,14 +1615,10 @@ extern Status CreateLoggerFromOptions(const std::string& dbname,
 struct CompactionOptions {
   // Compaction output compression type
   // Default: snappy
-  CompressionType compression;
+  CompressionType compression = kSnappyCompression;
   // Compaction will create files of size `output_file_size_limit`.
   // Default: MAX, which means that compaction will create a single file
-  uint64_t output_file_size_limit;
-
-  CompactionOptions()
-      : compression(kSnappyCompression),
-        output_file_size_limit(std::numeric_limits<uint64_t>::max()) {}
+  uint64_t output_file_size_limit = std::numeric_limits<uint64_t>::max();
 };
 
 // For level based compaction, we can configure if we want to skip/force
@@ -312,6 +312,30 @@ bool GoodCompressionRatio(size_t compressed_size, size_t raw_size) {
   return compressed_size < raw_size - (raw_size / 8u);
 }
 
+// Cheap probe for blocks that have no chance of passing
+// GoodCompressionRatio(): count the distinct byte values in a prefix of the
+// block. A 512-byte sample of uniformly random data (already-compressed or
+// encrypted payloads) contains ~220 distinct values in expectation, while
+// keys and typical uncompressed values stay far below that. Blocks smaller
+// than the sample are always handed to the compression library.
+bool LikelyCompressible(const Slice& raw) {
+  static const size_t kSampleBytes = 512;
+  static const int kMaxDistinctValues = 200;
+  if (raw.size() < kSampleBytes) {
+    return true;
+  }
+  bool seen[256] = {};
+  int distinct = 0;
+  for (size_t i = 0; i < kSampleBytes; i++) {
+    unsigned char c = static_cast<unsigned char>(raw.data()[i]);
+    if (!seen[c]) {
+      seen[c] = true;
+      distinct++;
+    }
+  }
+  return distinct <= kMaxDistinctValues;
+}
+
 // format_version is the block format as defined in include/rocksdb/table.h
 Slice CompressBlock(const Slice& raw,
                     const CompressionOptions& compression_options,
@@ -322,6 +346,11 @@ Slice CompressBlock(const Slice& raw,
     return raw;
   }
 
+  if (compression_options.probe_compressibility && !LikelyCompressible(raw)) {
+    *type = kNoCompression;
+    return raw;
+  }
+
   // Will return compressed block contents if (1) the compression method is
   // supported in this platform and (2) the compression rate is "good enough".
   switch (*type) {
@@ -375,6 +404,7 @@ Slice CompressBlock(const Slice& raw,
         return *compressed_output;
       }
       break;
+    case kZSTDCompression:
     case kZSTDNotFinalCompression:
       if (ZSTD_Compress(compression_options, raw.data(), raw.size(),
                         compressed_output, compression_dict) &&
@@ -468,6 +498,9 @@ struct BlockBasedTableBuilder::Rep {
   std::unique_ptr<IndexBuilder> index_builder;
 
   std::string last_key;
+  // Kept by value and next to each other: CompressBlock() reads the type and
+  // the codec parameters together for every block, so they should come from
+  // the same cache line rather than chasing a pointer back into the options.
   const CompressionType compression_type;
   const CompressionOptions compression_opts;
   // Data for presetting the compression library's dictionary, or nullptr.
@@ -519,6 +552,12 @@ struct BlockBasedTableBuilder::Rep {
                 table_options, data_block)),
         column_family_id(_column_family_id),
         column_family_name(_column_family_name) {
+    // compressed_output is reused for every block; size it for a block_size'd
+    // input up front, with 25% slack for codecs whose worst-case output is
+    // larger than their input (e.g. snappy's MaxCompressedLength), so the
+    // first blocks don't pay a chain of reallocations.
+    compressed_output.reserve(table_options.block_size +
+                              table_options.block_size / 4);
     for (auto& collector_factories : *int_tbl_prop_collector_factories) {
       table_properties_collectors.emplace_back(
           collector_factories->CreateIntTblPropCollector(column_family_id));
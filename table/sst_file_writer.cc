@@ -76,7 +76,10 @@ struct SstFileWriter::Rep {
       : env_options(_env_options),
         ioptions(options),
         mutable_cf_options(options, ioptions),
-        internal_comparator(_user_comparator) {}
+        internal_comparator(_user_comparator),
+        // ioptions clamps compression_per_level to its inline capacity, so
+        // remember the configured size for validation in Open().
+        compression_per_level_size(options.compression_per_level.size()) {}
 
   std::unique_ptr<WritableFileWriter> file_writer;
   std::unique_ptr<TableBuilder> builder;
@@ -87,6 +90,7 @@ struct SstFileWriter::Rep {
   ExternalSstFileInfo file_info;
   std::string column_family_name;
   InternalKey ikey;
+  size_t compression_per_level_size;
 };
 
 SstFileWriter::SstFileWriter(const EnvOptions& env_options,
@@ -99,6 +103,15 @@ SstFileWriter::~SstFileWriter() { delete rep_; }
 Status SstFileWriter::Open(const std::string& file_path) {
   Rep* r = rep_;
   Status s;
+  // SstFileWriter does not go through DB::Open, so apply the same limit
+  // that CheckCompressionSupported() enforces for column families.
+  if (r->compression_per_level_size >
+      static_cast<size_t>(ImmutableCFOptions::kCompressionPerLevelCapacity)) {
+    return Status::InvalidArgument(
+        "compression_per_level cannot have more than " +
+        ToString(ImmutableCFOptions::kCompressionPerLevelCapacity) +
+        " entries.");
+  }
   std::unique_ptr<WritableFile> sst_file;
   s = r->ioptions.env->NewWritableFile(file_path, &sst_file, r->env_options);
   if (!s.ok()) {
@@ -108,9 +121,12 @@ Status SstFileWriter::Open(const std::string& file_path) {
   CompressionType compression_type;
   if (r->ioptions.bottommost_compression != kDisableCompressionOption) {
     compression_type = r->ioptions.bottommost_compression;
-  } else if (!r->ioptions.compression_per_level.empty()) {
+  } else if (r->ioptions.compression_per_level_length > 0) {
     // Use the compression of the last level if we have per level compression
-    compression_type = *(r->ioptions.compression_per_level.rbegin());
+    compression_type =
+        r->ioptions
+            .compression_per_level[r->ioptions.compression_per_level_length -
+                                   1];
   } else {
     compression_type = r->mutable_cf_options.compression;
   }
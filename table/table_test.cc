@@ -580,6 +580,10 @@ static std::vector<TestArgs> GenerateArgList() {
     compression_types.emplace_back(kXpressCompression, true);
   }
   if (ZSTD_Supported()) {
+    compression_types.emplace_back(kZSTDCompression, false);
+    compression_types.emplace_back(kZSTDCompression, true);
+  }
+  if (ZSTDNotFinal_Supported()) {
     compression_types.emplace_back(kZSTDNotFinalCompression, false);
     compression_types.emplace_back(kZSTDNotFinalCompression, true);
   }
@@ -2181,6 +2185,50 @@ TEST_F(GeneralTableTest, ApproximateOffsetOfCompressed) {
   }
 }
 
+TEST_F(GeneralTableTest, CompressibilityProbe) {
+  CompressionType comp;
+  if (Snappy_Supported()) {
+    comp = kSnappyCompression;
+  } else if (Zlib_Supported()) {
+    comp = kZlibCompression;
+  } else if (LZ4_Supported()) {
+    comp = kLZ4Compression;
+  } else {
+    fprintf(stderr, "skipping compressibility probe test, no compression\n");
+    return;
+  }
+
+  Random rnd(301);
+  // Larger than the 512-byte probe sample and drawn from the full byte
+  // range, so the probe classifies its blocks as incompressible.
+  std::string high_entropy(10000, '\0');
+  for (size_t i = 0; i < high_entropy.size(); i++) {
+    high_entropy[i] = static_cast<char>(rnd.Uniform(256));
+  }
+
+  TableConstructor c(BytewiseComparator());
+  std::string tmp;
+  c.Add("k01", high_entropy);
+  c.Add("k02", test::CompressibleString(&rnd, 0.25, 10000, &tmp));
+  std::vector<std::string> keys;
+  stl_wrappers::KVMap kvmap;
+  Options options;
+  test::PlainInternalKeyComparator ikc(options.comparator);
+  options.compression = comp;
+  options.compression_opts.probe_compressibility = true;
+  BlockBasedTableOptions table_options;
+  table_options.block_size = 1024;
+  const ImmutableCFOptions ioptions(options);
+  c.Finish(options, ioptions, table_options, ikc, &keys, &kvmap);
+
+  // k01's high-entropy blocks skip the compression library and are stored
+  // verbatim...
+  ASSERT_TRUE(Between(c.ApproximateOffsetOf("k02"), 10000, 11000));
+  // ...while k02's compressible blocks still go through it and shrink.
+  ASSERT_TRUE(Between(c.ApproximateOffsetOf("xyz"), 12000, 14000));
+  c.ResetTableReader();
+}
+
 TEST_F(HarnessTest, Randomized) {
   std::vector<TestArgs> args = GenerateArgList();
   for (unsigned int i = 0; i < args.size(); i++) {
@@ -193,6 +193,7 @@ int SstFileReader::ShowAllCompressionSizes(size_t block_size) {
     { CompressionType::kLZ4Compression, "kLZ4Compression" },
     { CompressionType::kLZ4HCCompression, "kLZ4HCCompression" },
     { CompressionType::kXpressCompression, "kXpressCompression" },
+    { CompressionType::kZSTDCompression, "kZSTDCompression" },
     { CompressionType::kZSTDNotFinalCompression, "kZSTDNotFinalCompression" }
   };
 
@@ -79,6 +79,14 @@ inline bool XPRESS_Supported() {
 }
 
 inline bool ZSTD_Supported() {
+#ifdef ZSTD
+  // The on-disk format of zstd was finalized in v0.8.0.
+  return (ZSTD_versionNumber() >= 800);
+#endif
+  return false;
+}
+
+inline bool ZSTDNotFinal_Supported() {
 #ifdef ZSTD
   return true;
 #endif
@@ -101,8 +109,10 @@ inline bool CompressionTypeSupported(CompressionType compression_type) {
       return LZ4_Supported();
     case kXpressCompression:
       return XPRESS_Supported();
-    case kZSTDNotFinalCompression:
+    case kZSTDCompression:
       return ZSTD_Supported();
+    case kZSTDNotFinalCompression:
+      return ZSTDNotFinal_Supported();
     default:
       assert(false);
       return false;
@@ -125,8 +135,10 @@ inline std::string CompressionTypeToString(CompressionType compression_type) {
       return "LZ4HC";
     case kXpressCompression:
       return "Xpress";
-    case kZSTDNotFinalCompression:
+    case kZSTDCompression:
       return "ZSTD";
+    case kZSTDNotFinalCompression:
+      return "ZSTDNotFinal";
     default:
       assert(false);
       return "";
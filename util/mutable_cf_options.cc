@@ -38,6 +38,8 @@ uint64_t MultiplyCheckOverflow(uint64_t op1, int op2) {
 void MutableCFOptions::RefreshDerivedOptions(
     const ImmutableCFOptions& ioptions) {
   max_file_size.resize(ioptions.num_levels);
+  max_grandparent_overlap_bytes.resize(ioptions.num_levels);
+  expanded_compaction_byte_size_limit.resize(ioptions.num_levels);
   for (int i = 0; i < ioptions.num_levels; ++i) {
     if (i == 0 && ioptions.compaction_style == kCompactionStyleUniversal) {
       max_file_size[i] = ULLONG_MAX;
@@ -47,6 +49,10 @@ void MutableCFOptions::RefreshDerivedOptions(
     } else {
       max_file_size[i] = target_file_size_base;
     }
+    max_grandparent_overlap_bytes[i] =
+        MultiplyCheckOverflow(max_file_size[i], max_grandparent_overlap_factor);
+    expanded_compaction_byte_size_limit[i] =
+        MultiplyCheckOverflow(max_file_size[i], expanded_compaction_factor);
   }
 }
 
@@ -56,10 +62,14 @@ uint64_t MutableCFOptions::MaxFileSizeForLevel(int level) const {
   return max_file_size[level];
 }
 uint64_t MutableCFOptions::MaxGrandParentOverlapBytes(int level) const {
-  return MaxFileSizeForLevel(level) * max_grandparent_overlap_factor;
+  assert(level >= 0);
+  assert(level < (int)max_grandparent_overlap_bytes.size());
+  return max_grandparent_overlap_bytes[level];
 }
 uint64_t MutableCFOptions::ExpandedCompactionByteSizeLimit(int level) const {
-  return MaxFileSizeForLevel(level) * expanded_compaction_factor;
+  assert(level >= 0);
+  assert(level < (int)expanded_compaction_byte_size_limit.size());
+  return expanded_compaction_byte_size_limit[level];
 }
 
 void MutableCFOptions::Dump(Logger* log) const {
@@ -104,8 +114,9 @@ void MutableCFOptions::Dump(Logger* log) const {
       max_bytes_for_level_multiplier);
   std::string result;
   char buf[10];
-  for (const auto m : max_bytes_for_level_multiplier_additional) {
-    snprintf(buf, sizeof(buf), "%d, ", m);
+  for (int i = 0; i < max_bytes_for_level_multiplier_additional_length; i++) {
+    snprintf(buf, sizeof(buf), "%d, ",
+             max_bytes_for_level_multiplier_additional[i]);
     result += buf;
   }
   result.resize(result.size() - 2);
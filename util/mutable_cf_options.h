@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <vector>
 #include "rocksdb/immutable_options.h"
 #include "rocksdb/options.h"
@@ -40,8 +42,6 @@ struct MutableCFOptions {
         target_file_size_multiplier(options.target_file_size_multiplier),
         max_bytes_for_level_base(options.max_bytes_for_level_base),
         max_bytes_for_level_multiplier(options.max_bytes_for_level_multiplier),
-        max_bytes_for_level_multiplier_additional(
-            options.max_bytes_for_level_multiplier_additional),
         verify_checksums_in_compaction(options.verify_checksums_in_compaction),
         max_subcompactions(options.max_subcompactions),
         max_sequential_skip_in_iterations(
@@ -51,6 +51,18 @@ struct MutableCFOptions {
         compression(options.compression),
         min_partial_merge_operands(options.min_partial_merge_operands),
         compaction_options_fifo(ioptions.compaction_options_fifo) {
+    // CheckMaxBytesMultiplierAdditional() guarantees before a column family
+    // is opened that every entry past the inline capacity holds the default
+    // multiplier of 1, which is also what MaxBytesMultiplerAdditional()
+    // returns for levels past the stored length, so dropping the tail here
+    // does not change any level's multiplier.
+    max_bytes_for_level_multiplier_additional_length = static_cast<int>(
+        std::min(options.max_bytes_for_level_multiplier_additional.size(),
+                 static_cast<size_t>(kMultiplierAdditionalCapacity)));
+    for (int i = 0; i < max_bytes_for_level_multiplier_additional_length; i++) {
+      max_bytes_for_level_multiplier_additional[i] =
+          options.max_bytes_for_level_multiplier_additional[i];
+    }
     RefreshDerivedOptions(ioptions);
   }
   MutableCFOptions()
@@ -75,6 +87,7 @@ struct MutableCFOptions {
         target_file_size_multiplier(0),
         max_bytes_for_level_base(0),
         max_bytes_for_level_multiplier(0),
+        max_bytes_for_level_multiplier_additional_length(0),
         verify_checksums_in_compaction(false),
         max_subcompactions(1),
         max_sequential_skip_in_iterations(0),
@@ -94,8 +107,7 @@ struct MutableCFOptions {
   uint64_t MaxGrandParentOverlapBytes(int level) const;
   uint64_t ExpandedCompactionByteSizeLimit(int level) const;
   int MaxBytesMultiplerAdditional(int level) const {
-    if (level >=
-        static_cast<int>(max_bytes_for_level_multiplier_additional.size())) {
+    if (level >= max_bytes_for_level_multiplier_additional_length) {
       return 1;
     }
     return max_bytes_for_level_multiplier_additional[level];
@@ -127,7 +139,21 @@ struct MutableCFOptions {
   int target_file_size_multiplier;
   uint64_t max_bytes_for_level_base;
   int max_bytes_for_level_multiplier;
-  std::vector<int> max_bytes_for_level_multiplier_additional;
+
+  // Maximum number of per-level entries stored inline for
+  // max_bytes_for_level_multiplier_additional below.
+  static const int kMultiplierAdditionalCapacity = 16;
+
+  // Stored inline (MutableCFOptions is copied whenever a compaction is
+  // picked, and a vector copy means a heap allocation). Only the first
+  // max_bytes_for_level_multiplier_additional_length entries are valid;
+  // levels beyond that use the default multiplier of 1, exactly as
+  // MaxBytesMultiplerAdditional() already does for levels past the end of
+  // the configured vector.
+  std::array<int, kMultiplierAdditionalCapacity>
+      max_bytes_for_level_multiplier_additional;
+  int max_bytes_for_level_multiplier_additional_length;
+
   bool verify_checksums_in_compaction;
   int max_subcompactions;
 
@@ -142,6 +168,12 @@ struct MutableCFOptions {
   // Derived options
   // Per-level target file size.
   std::vector<uint64_t> max_file_size;
+  // Per-level max_file_size * max_grandparent_overlap_factor, so the
+  // compaction picker reads a single precomputed value instead of
+  // multiplying on every call.
+  std::vector<uint64_t> max_grandparent_overlap_bytes;
+  // Per-level max_file_size * expanded_compaction_factor.
+  std::vector<uint64_t> expanded_compaction_byte_size_limit;
 };
 
 uint64_t MultiplyCheckOverflow(uint64_t op1, int op2);
@@ -15,6 +15,7 @@
 #endif
 
 #include <inttypes.h>
+#include <algorithm>
 #include <limits>
 
 #include "rocksdb/cache.h"
@@ -37,25 +38,28 @@
 namespace rocksdb {
 
 ImmutableCFOptions::ImmutableCFOptions(const Options& options)
-    : compaction_style(options.compaction_style),
-      compaction_options_universal(options.compaction_options_universal),
-      compaction_options_fifo(options.compaction_options_fifo),
+    : comparator(options.comparator),
       prefix_extractor(options.prefix_extractor.get()),
-      comparator(options.comparator),
       merge_operator(options.merge_operator.get()),
-      compaction_filter(options.compaction_filter),
-      compaction_filter_factory(options.compaction_filter_factory.get()),
-      inplace_update_support(options.inplace_update_support),
-      inplace_callback(options.inplace_callback),
-      info_log(options.info_log.get()),
       statistics(options.statistics.get()),
+      info_log(options.info_log.get()),
       env(options.env),
+      num_levels(options.num_levels),
+      optimize_filters_for_hits(options.optimize_filters_for_hits),
+      inplace_update_support(options.inplace_update_support),
+      inplace_callback(options.inplace_callback),
+      memtable_factory(options.memtable_factory.get()),
+      table_factory(options.table_factory.get()),
+      row_cache(options.row_cache),
+      compaction_style(options.compaction_style),
+      compaction_options_universal(options.compaction_options_universal),
+      compaction_options_fifo(options.compaction_options_fifo),
+      compaction_filter(options.compaction_filter),
+      compaction_filter_factory(options.compaction_filter_factory.get()),
       delayed_write_rate(options.delayed_write_rate),
       allow_mmap_reads(options.allow_mmap_reads),
       allow_mmap_writes(options.allow_mmap_writes),
       db_paths(options.db_paths),
-      memtable_factory(options.memtable_factory.get()),
-      table_factory(options.table_factory.get()),
       table_properties_collector_factories(
           options.table_properties_collector_factories),
       advise_random_on_open(options.advise_random_on_open),
@@ -63,7 +67,6 @@ ImmutableCFOptions::ImmutableCFOptions(const Options& options)
       purge_redundant_kvs_while_flush(options.purge_redundant_kvs_while_flush),
       disable_data_sync(options.disableDataSync),
       use_fsync(options.use_fsync),
-      compression_per_level(options.compression_per_level),
       bottommost_compression(options.bottommost_compression),
       compression_opts(options.compression_opts),
       level_compaction_dynamic_level_bytes(
@@ -72,10 +75,17 @@ ImmutableCFOptions::ImmutableCFOptions(const Options& options)
       new_table_reader_for_compaction_inputs(
           options.new_table_reader_for_compaction_inputs),
       compaction_readahead_size(options.compaction_readahead_size),
-      num_levels(options.num_levels),
-      optimize_filters_for_hits(options.optimize_filters_for_hits),
-      listeners(options.listeners),
-      row_cache(options.row_cache) {}
+      listeners(options.listeners) {
+  // Overlong vectors are rejected by CheckCompressionSupported() before a
+  // column family is opened and by SstFileWriter::Open(); clamp defensively
+  // for any other caller.
+  compression_per_level_length = static_cast<int>(
+      std::min(options.compression_per_level.size(),
+               static_cast<size_t>(kCompressionPerLevelCapacity)));
+  for (int i = 0; i < compression_per_level_length; i++) {
+    compression_per_level[i] = options.compression_per_level[i];
+  }
+}
 
 ColumnFamilyOptions::ColumnFamilyOptions()
     : comparator(BytewiseComparator()),
@@ -86,7 +96,10 @@ ColumnFamilyOptions::ColumnFamilyOptions()
       max_write_buffer_number(2),
       min_write_buffer_number_to_merge(1),
       max_write_buffer_number_to_maintain(0),
-      compression(Snappy_Supported() ? kSnappyCompression : kNoCompression),
+      compression(LZ4_Supported()
+                      ? kLZ4Compression
+                      : (Snappy_Supported() ? kSnappyCompression
+                                            : kNoCompression)),
       bottommost_compression(kDisableCompressionOption),
       prefix_extractor(nullptr),
       num_levels(7),
@@ -228,7 +241,7 @@ DBOptions::DBOptions()
       wal_dir(""),
       delete_obsolete_files_period_micros(6ULL * 60 * 60 * 1000000),
       base_background_compactions(1),
-      max_background_compactions(1),
+      max_background_compactions(2),
       max_subcompactions(1),
       max_background_flushes(1),
       max_log_file_size(0),
@@ -261,7 +274,7 @@ DBOptions::DBOptions()
       enable_thread_tracking(false),
       delayed_write_rate(2 * 1024U * 1024U),
       allow_concurrent_memtable_write(false),
-      enable_write_thread_adaptive_yield(false),
+      enable_write_thread_adaptive_yield(true),
       write_thread_max_yield_usec(100),
       write_thread_slow_yield_usec(3),
       skip_stats_update_on_db_open(false),
@@ -374,10 +387,7 @@ void DBOptions::Dump(Logger* log) const {
          keep_log_file_num);
     Header(log, "  Options.recycle_log_file_num: %" ROCKSDB_PRIszt,
            recycle_log_file_num);
-    Header(log, "       Options.allow_os_buffer: %d", allow_os_buffer);
-    Header(log, "      Options.allow_mmap_reads: %d", allow_mmap_reads);
     Header(log, "      Options.allow_fallocate: %d", allow_fallocate);
-    Header(log, "     Options.allow_mmap_writes: %d", allow_mmap_writes);
     Header(log, "         Options.create_missing_column_families: %d",
         create_missing_column_families);
     Header(log, "                             Options.db_log_dir: %s",
@@ -517,6 +527,8 @@ void ColumnFamilyOptions::Dump(Logger* log) const {
     Header(log,
         "        Options.compression_opts.max_dict_bytes: %" ROCKSDB_PRIszt,
         compression_opts.max_dict_bytes);
+    Header(log, "  Options.compression_opts.probe_compressibility: %d",
+        compression_opts.probe_compressibility);
     Header(log, "     Options.level0_file_num_compaction_trigger: %d",
         level0_file_num_compaction_trigger);
     Header(log, "         Options.level0_slowdown_writes_trigger: %d",
@@ -694,6 +706,11 @@ DBOptions* DBOptions::OldDefaults(int rocksdb_major_version,
     max_file_opening_threads = 1;
     table_cache_numshardbits = 4;
   }
+  if (rocksdb_major_version < 4 ||
+      (rocksdb_major_version == 4 && rocksdb_minor_version < 10)) {
+    max_background_compactions = 1;
+    enable_write_thread_adaptive_yield = false;
+  }
   max_open_files = 5000;
   base_background_compactions = -1;
   wal_recovery_mode = WALRecoveryMode::kTolerateCorruptedTailRecords;
@@ -710,6 +727,10 @@ ColumnFamilyOptions* ColumnFamilyOptions::OldDefaults(
     soft_pending_compaction_bytes_limit = 0;
     hard_pending_compaction_bytes_limit = 0;
   }
+  if (rocksdb_major_version < 4 ||
+      (rocksdb_major_version == 4 && rocksdb_minor_version < 10)) {
+    compression = Snappy_Supported() ? kSnappyCompression : kNoCompression;
+  }
   compaction_pri = CompactionPri::kByCompensatedSize;
 
   return this;
@@ -765,15 +786,24 @@ ColumnFamilyOptions* ColumnFamilyOptions::OptimizeLevelStyleCompaction(
   // level style compaction
   compaction_style = kCompactionStyleLevel;
 
-  // only compress levels >= 2
+  // only compress levels >= 2, using a cheap codec. The bottommost level
+  // holds the bulk of the data but is compacted into rarely, so spend more
+  // compression CPU there for a better ratio.
+  CompressionType fast_compression =
+      LZ4_Supported()
+          ? kLZ4Compression
+          : (Snappy_Supported() ? kSnappyCompression : kNoCompression);
   compression_per_level.resize(num_levels);
   for (int i = 0; i < num_levels; ++i) {
     if (i < 2) {
       compression_per_level[i] = kNoCompression;
     } else {
-      compression_per_level[i] = kSnappyCompression;
+      compression_per_level[i] = fast_compression;
     }
   }
+  if (LZ4_Supported()) {
+    bottommost_compression = kLZ4HCCompression;
+  }
   return this;
 }
 
@@ -801,36 +831,42 @@ DBOptions* DBOptions::IncreaseParallelism(int total_threads) {
 
 #endif  // !ROCKSDB_LITE
 
+// ReadOptions and WriteOptions are copied into every read/write; keep them
+// within a cache line. These bounds hold on 64-bit platforms and are only
+// smaller on 32-bit ones.
+static_assert(sizeof(ReadOptions) <= 40, "ReadOptions has grown");
+static_assert(sizeof(WriteOptions) <= 16, "WriteOptions has grown");
+
 ReadOptions::ReadOptions()
-    : verify_checksums(true),
-      fill_cache(true),
-      snapshot(nullptr),
+    : snapshot(nullptr),
       iterate_upper_bound(nullptr),
+      readahead_size(0),
       read_tier(kReadAllTier),
+      verify_checksums(true),
+      fill_cache(true),
       tailing(false),
       managed(false),
       total_order_seek(false),
       prefix_same_as_start(false),
       pin_data(false),
-      background_purge_on_iterator_cleanup(false),
-      readahead_size(0) {
+      background_purge_on_iterator_cleanup(false) {
   XFUNC_TEST("", "managed_options", managed_options, xf_manage_options,
              reinterpret_cast<ReadOptions*>(this));
 }
 
 ReadOptions::ReadOptions(bool cksum, bool cache)
-    : verify_checksums(cksum),
-      fill_cache(cache),
-      snapshot(nullptr),
+    : snapshot(nullptr),
       iterate_upper_bound(nullptr),
+      readahead_size(0),
       read_tier(kReadAllTier),
+      verify_checksums(cksum),
+      fill_cache(cache),
       tailing(false),
       managed(false),
       total_order_seek(false),
       prefix_same_as_start(false),
       pin_data(false),
-      background_purge_on_iterator_cleanup(false),
-      readahead_size(0) {
+      background_purge_on_iterator_cleanup(false) {
   XFUNC_TEST("", "managed_options", managed_options, xf_manage_options,
              reinterpret_cast<ReadOptions*>(this));
 }
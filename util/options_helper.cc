@@ -559,6 +559,38 @@ bool ParseMemtableOptions(const std::string& name, const std::string& value,
   return true;
 }
 
+void SetMaxBytesForLevelMultiplierAdditional(const std::vector<int>& values,
+                                             ColumnFamilyOptions* new_options) {
+  new_options->max_bytes_for_level_multiplier_additional = values;
+}
+
+void SetMaxBytesForLevelMultiplierAdditional(const std::vector<int>& values,
+                                             MutableCFOptions* new_options) {
+  // Only the first kMultiplierAdditionalCapacity entries can be stored
+  // inline; levels past the stored length use the default multiplier of 1.
+  // Reject input that would lose a non-default entry rather than silently
+  // rewriting the user's configuration, mirroring
+  // CheckMaxBytesMultiplierAdditional() at column family open.
+  for (size_t i = MutableCFOptions::kMultiplierAdditionalCapacity;
+       i < values.size(); i++) {
+    if (values[i] != 1) {
+      throw std::invalid_argument(
+          "max_bytes_for_level_multiplier_additional cannot have a "
+          "non-default entry beyond level " +
+          ToString(MutableCFOptions::kMultiplierAdditionalCapacity - 1));
+    }
+  }
+  new_options->max_bytes_for_level_multiplier_additional_length =
+      static_cast<int>(std::min(
+          values.size(),
+          static_cast<size_t>(
+              MutableCFOptions::kMultiplierAdditionalCapacity)));
+  for (int i = 0;
+       i < new_options->max_bytes_for_level_multiplier_additional_length; i++) {
+    new_options->max_bytes_for_level_multiplier_additional[i] = values[i];
+  }
+}
+
 template<typename OptionsType>
 bool ParseCompactionOptions(const std::string& name, const std::string& value,
                             OptionsType* new_options) {
@@ -595,20 +627,19 @@ bool ParseCompactionOptions(const std::string& name, const std::string& value,
   } else if (name == "max_bytes_for_level_multiplier") {
     new_options->max_bytes_for_level_multiplier = ParseInt(value);
   } else if (name == "max_bytes_for_level_multiplier_additional") {
-    new_options->max_bytes_for_level_multiplier_additional.clear();
+    std::vector<int> parsed;
     size_t start = 0;
     while (true) {
       size_t end = value.find(':', start);
       if (end == std::string::npos) {
-        new_options->max_bytes_for_level_multiplier_additional.push_back(
-            ParseInt(value.substr(start)));
+        parsed.push_back(ParseInt(value.substr(start)));
         break;
       } else {
-        new_options->max_bytes_for_level_multiplier_additional.push_back(
-            ParseInt(value.substr(start, end - start)));
+        parsed.push_back(ParseInt(value.substr(start, end - start)));
         start = end + 1;
       }
     }
+    SetMaxBytesForLevelMultiplierAdditional(parsed, new_options);
   } else if (name == "verify_checksums_in_compaction") {
     new_options->verify_checksums_in_compaction = ParseBoolean(name, value);
   } else {
@@ -832,8 +863,19 @@ Status ParseColumnFamilyOption(const std::string& name,
           return Status::InvalidArgument(
               "unable to parse the specified CF option " + name);
         }
+        end = value.find(':', start);
         new_options->compression_opts.max_dict_bytes =
             ParseInt(value.substr(start, value.size() - start));
+        // probe_compressibility is optional as well
+        if (end != std::string::npos) {
+          start = end + 1;
+          if (start >= value.size()) {
+            return Status::InvalidArgument(
+                "unable to parse the specified CF option " + name);
+          }
+          new_options->compression_opts.probe_compressibility =
+              ParseInt(value.substr(start, value.size() - start)) != 0;
+        }
       }
     } else if (name == "compaction_options_fifo") {
       new_options->compaction_options_fifo.max_table_files_size =
@@ -1473,9 +1515,11 @@ ColumnFamilyOptions BuildColumnFamilyOptions(
       mutable_cf_options.max_bytes_for_level_multiplier;
 
   cf_opts.max_bytes_for_level_multiplier_additional.clear();
-  for (auto value :
-       mutable_cf_options.max_bytes_for_level_multiplier_additional) {
-    cf_opts.max_bytes_for_level_multiplier_additional.emplace_back(value);
+  for (int i = 0;
+       i < mutable_cf_options.max_bytes_for_level_multiplier_additional_length;
+       i++) {
+    cf_opts.max_bytes_for_level_multiplier_additional.emplace_back(
+        mutable_cf_options.max_bytes_for_level_multiplier_additional[i]);
   }
 
   cf_opts.verify_checksums_in_compaction =
@@ -588,6 +588,7 @@ static std::unordered_map<std::string, CompressionType>
         {"kLZ4Compression", kLZ4Compression},
         {"kLZ4HCCompression", kLZ4HCCompression},
         {"kXpressCompression", kXpressCompression},
+        {"kZSTDCompression", kZSTDCompression},
         {"kZSTDNotFinalCompression", kZSTDNotFinalCompression},
         {"kDisableCompressionOption", kDisableCompressionOption}};
 